@@ -2,6 +2,30 @@
 #include <string>
 #include <ctime>
 #include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+#ifdef __linux__
+#include <deque>
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#endif
 using namespace std;
 
 struct TaskNode
@@ -20,8 +44,10 @@ struct TaskNode
 
 struct StackNode
 {
-    TaskNode*  task;
-    StackNode* next;
+    TaskNode*   task;
+    vector<int> dependsOn;    // dependency edges removed along with the task
+    vector<int> dependents;
+    StackNode*  next;
 };
 
 class UndoStack
@@ -30,28 +56,35 @@ class UndoStack
 public:
     UndoStack() : top(nullptr) {}
 
-    void push(TaskNode* t)
+    void push(TaskNode* t, const vector<int>& dependsOn = vector<int>(),
+              const vector<int>& dependents = vector<int>())
     {
         TaskNode* copy = new TaskNode();
         *copy      = *t;
         copy->next = nullptr;
 
-        StackNode* sn = new StackNode();
-        sn->task = copy;
-        sn->next = top;
-        top      = sn;
+        StackNode* sn  = new StackNode();
+        sn->task       = copy;
+        sn->dependsOn  = dependsOn;
+        sn->dependents = dependents;
+        sn->next       = top;
+        top            = sn;
     }
 
-    TaskNode* pop()
+    TaskNode* pop(vector<int>* dependsOn = nullptr, vector<int>* dependents = nullptr)
     {
         if (!top) return nullptr;
         StackNode* tmp  = top;
         TaskNode*  task = tmp->task;
+        if (dependsOn)  dependsOn->swap(tmp->dependsOn);
+        if (dependents) dependents->swap(tmp->dependents);
         top = top->next;
         delete tmp;
         return task;
     }
 
+    const TaskNode* peek() const { return top ? top->task : nullptr; }
+
     bool isEmpty() const { return top == nullptr; }
 
     ~UndoStack()
@@ -60,91 +93,176 @@ public:
     }
 };
 
-struct HeapEntry
+// Tie-breakers for entries with equal keys. Task IDs are handed out in
+// creation order, so TieById keeps equal priorities first-come first-served.
+struct TieById
+{
+    bool operator()(int a, int b) const { return a < b; }
+};
+
+struct NoTieBreak
+{
+    bool operator()(int, int) const { return false; }
+};
+
+template <typename Key>
+struct BasicHeapEntry
 {
-    int priority;
+    Key priority;
     int taskId;
 };
 
-class MinHeap
+struct HeapBenchOp
 {
-    static const int MAX = 500;
-    HeapEntry heap[MAX];
-    int       sz;
+    char kind;     // 'i' insert, 'p' pop min, 'u' update, 'r' remove by id
+    int  id, key;
+};
+
+// D-ary heap with an id -> slot index for O(log n) remove/update by task ID.
+// Logical node i is stored at slot[i + D - 1], which puts the D children of
+// every node (D*i+1 .. D*i+D) at a slot index that is a multiple of D; with
+// 8-byte entries and a 64-byte aligned array each sibling group then sits in
+// a single cache line for D = 2, 4 and 8.
+template <int D, typename Key = int, typename Compare = less<Key>,
+          typename TieBreak = TieById, int MAX = 500>
+class DaryHeap
+{
+    static_assert(D >= 2, "heap arity must be at least 2");
+
+public:
+    typedef BasicHeapEntry<Key> Entry;
+    static const int CAPACITY = MAX;
+
+    // When set, every effective insert/update/remove is appended here so
+    // --bench-heap can time the arities on the calls TodoList really makes.
+    static vector<HeapBenchOp>* opLog;
+
+private:
+    alignas(64) Entry slot[MAX + D];
+    vector<int> pos;
+    int         sz;
+    Compare     cmp;
+    TieBreak    tie;
 
-    int parent(int i) { return (i - 1) / 2; }
-    int left(int i)   { return 2 * i + 1;   }
-    int right(int i)  { return 2 * i + 2;   }
+    Entry&       at(int i)       { return slot[i + D - 1]; }
+    const Entry& at(int i) const { return slot[i + D - 1]; }
 
-    void swp(int i, int j)
+    bool before(const Entry& a, const Entry& b) const
     {
-        HeapEntry t = heap[i]; heap[i] = heap[j]; heap[j] = t;
+        if (cmp(a.priority, b.priority)) return true;
+        if (cmp(b.priority, a.priority)) return false;
+        return tie(a.taskId, b.taskId);
     }
 
-    void heapifyUp(int i)
+    void place(int i, const Entry& e)
     {
-        while (i > 0 && heap[i].priority < heap[parent(i)].priority)
-        { swp(i, parent(i)); i = parent(i); }
+        at(i) = e;
+        pos[e.taskId] = i;
     }
 
-    void heapifyDown(int i)
+    void siftUp(int i)
     {
-        int s = i, l = left(i), r = right(i);
-        if (l < sz && heap[l].priority < heap[s].priority) s = l;
-        if (r < sz && heap[r].priority < heap[s].priority) s = r;
-        if (s != i) { swp(i, s); heapifyDown(s); }
+        Entry e = at(i);
+        while (i > 0)
+        {
+            int p = (i - 1) / D;
+            if (!before(e, at(p))) break;
+            place(i, at(p));
+            i = p;
+        }
+        place(i, e);
+    }
+
+    void siftDown(int i)
+    {
+        Entry e = at(i);
+        while (true)
+        {
+            int first = D * i + 1;
+            if (first >= sz) break;
+            int best = first;
+            if (first + D <= sz)
+                for (int k = first + 1; k < first + D; k++)
+                    best = before(at(k), at(best)) ? k : best;
+            else
+                for (int k = first + 1; k < sz; k++)
+                    best = before(at(k), at(best)) ? k : best;
+            if (!before(at(best), e)) break;
+            place(i, at(best));
+            i = best;
+        }
+        place(i, e);
     }
 
 public:
-    MinHeap() : sz(0) {}
+    DaryHeap() : sz(0) {}
 
-    void insert(int priority, int taskId)
+    bool contains(int taskId) const
+    {
+        return taskId >= 0 && taskId < (int)pos.size() && pos[taskId] >= 0;
+    }
+
+    void insert(Key priority, int taskId)
     {
+        if (contains(taskId)) { updatePriority(taskId, priority); return; }
         if (sz >= MAX) { cout << "  [!] Heap full.\n"; return; }
-        heap[sz] = {priority, taskId};
-        heapifyUp(sz++);
+        if (opLog) opLog->push_back({'i', taskId, int(priority)});
+        if (taskId >= (int)pos.size()) pos.resize(taskId + 1, -1);
+        at(sz) = {priority, taskId};
+        pos[taskId] = sz;
+        siftUp(sz++);
     }
 
-    HeapEntry peekMin() const { return heap[0]; }
+    Entry peekMin() const { return at(0); }
 
     void removeById(int taskId)
     {
-        int idx = -1;
-        for (int i = 0; i < sz; i++)
-            if (heap[i].taskId == taskId) { idx = i; break; }
-        if (idx == -1) return;
-        heap[idx] = heap[--sz];
-        if (idx < sz) { heapifyUp(idx); heapifyDown(idx); }
+        if (!contains(taskId)) return;
+        if (opLog) opLog->push_back({'r', taskId, 0});
+        int   idx  = pos[taskId];
+        Entry gone = at(idx);
+        pos[taskId] = -1;
+        if (idx == --sz) return;
+        place(idx, at(sz));
+        if (before(at(idx), gone)) siftUp(idx);
+        else                       siftDown(idx);
     }
 
-    void updatePriority(int taskId, int newPri)
+    void updatePriority(int taskId, Key newPri)
     {
-        for (int i = 0; i < sz; i++)
-            if (heap[i].taskId == taskId)
-            {
-                heap[i].priority = newPri;
-                heapifyUp(i); heapifyDown(i);
-                return;
-            }
+        if (!contains(taskId)) return;
+        if (opLog) opLog->push_back({'u', taskId, int(newPri)});
+        int   i   = pos[taskId];
+        Entry old = at(i);
+        at(i).priority = newPri;
+        if (before(at(i), old)) siftUp(i);
+        else                    siftDown(i);
     }
 
-    void sortedSnapshot(HeapEntry* out, int& outSz) const
+    void sortedSnapshot(Entry* out, int& outSz) const
     {
         outSz = sz;
-        for (int i = 0; i < sz; i++) out[i] = heap[i];
-        for (int i = 0; i < outSz - 1; i++)
-        {
-            int m = i;
-            for (int j = i + 1; j < outSz; j++)
-                if (out[j].priority < out[m].priority) m = j;
-            HeapEntry t = out[i]; out[i] = out[m]; out[m] = t;
-        }
+        for (int i = 0; i < sz; i++) out[i] = at(i);
+        sort(out, out + outSz,
+             [this](const Entry& a, const Entry& b) { return before(a, b); });
     }
 
     bool isEmpty() const { return sz == 0; }
     int  size()    const { return sz; }
 };
 
+template <int D, typename Key, typename Compare, typename TieBreak, int MAX>
+vector<HeapBenchOp>* DaryHeap<D, Key, Compare, TieBreak, MAX>::opLog = nullptr;
+
+// Picked from `--bench-heap <trace>...` on the --generate cascade, planner
+// and depend mixes (see README); override with -DTODO_HEAP_ARITY=2|4|8.
+#ifndef TODO_HEAP_ARITY
+#define TODO_HEAP_ARITY 2
+#endif
+
+typedef DaryHeap<TODO_HEAP_ARITY> MinHeap;
+typedef MinHeap::Entry            HeapEntry;
+
 class PlannerQueue
 {
     static const int MAX = 100;
@@ -203,6 +321,365 @@ public:
     }
 };
 
+struct EdgeNode
+{
+    int       taskId;
+    EdgeNode* next;
+};
+
+// Dependency graph over task IDs. An edge dep -> task means "task depends on
+// dep". blockers counts the pending (not done, not deleted) dependencies of a
+// task and is kept up to date as tasks are resolved or restored, so readiness
+// never has to be recomputed (Kahn's in-degree idea, maintained online).
+// Cycles are rejected on insertion with the Pearce-Kelly dynamic topological
+// order: only the slice of the order between the two endpoints is searched.
+class DependencyGraph
+{
+    struct Vertex
+    {
+        EdgeNode* out;
+        EdgeNode* in;
+        int       blockers;
+        int       ord;
+        bool      pending;
+        bool      seen;
+
+        Vertex() : out(nullptr), in(nullptr), blockers(0), ord(0),
+                   pending(false), seen(false) {}
+    };
+
+    vector<Vertex> v;
+    int            nextOrd;
+    int            edges;
+
+    static void link(EdgeNode*& list, int id)
+    {
+        list = new EdgeNode{id, list};
+    }
+
+    static bool unlink(EdgeNode*& list, int id)
+    {
+        for (EdgeNode** p = &list; *p; p = &(*p)->next)
+            if ((*p)->taskId == id)
+            {
+                EdgeNode* dead = *p;
+                *p = dead->next;
+                delete dead;
+                return true;
+            }
+        return false;
+    }
+
+    // Collects vertices reachable from `from` (forward over out-edges or
+    // backward over in-edges) whose order lies within [lo, hi]. Returns
+    // false if `target` is reached.
+    bool collect(int from, bool forward, int lo, int hi, int target, vector<int>& found)
+    {
+        vector<int> stack(1, from);
+        v[from].seen = true;
+        found.push_back(from);
+        while (!stack.empty())
+        {
+            int u = stack.back(); stack.pop_back();
+            for (EdgeNode* e = forward ? v[u].out : v[u].in; e; e = e->next)
+            {
+                Vertex& w = v[e->taskId];
+                if (e->taskId == target) return false;
+                if (w.seen || w.ord < lo || w.ord > hi) continue;
+                w.seen = true;
+                found.push_back(e->taskId);
+                stack.push_back(e->taskId);
+            }
+        }
+        return true;
+    }
+
+    bool byOrd(int a, int b) const { return v[a].ord < v[b].ord; }
+
+public:
+    DependencyGraph() : nextOrd(0), edges(0) {}
+
+    void addTask(int id)
+    {
+        if (id >= (int)v.size()) v.resize(id + 1);
+        v[id].pending = true;
+        v[id].ord     = nextOrd++;
+    }
+
+    bool isBlocked(int id) const
+    {
+        return id < (int)v.size() && v[id].blockers > 0;
+    }
+
+    int blockedCount() const
+    {
+        int n = 0;
+        for (size_t i = 0; i < v.size(); i++)
+            if (v[i].pending && v[i].blockers > 0) n++;
+        return n;
+    }
+
+    int edgeCount() const { return edges; }
+
+    bool hasEdge(int task, int dep) const
+    {
+        for (EdgeNode* e = v[task].in; e; e = e->next)
+            if (e->taskId == dep) return true;
+        return false;
+    }
+
+    // Adds "task depends on dep". Returns false if that would close a cycle.
+    bool addEdge(int task, int dep)
+    {
+        if (task == dep) return false;
+        int lo = v[task].ord, hi = v[dep].ord;
+        if (hi > lo)
+        {
+            vector<int> fwd, back;
+            bool ok = collect(task, true, lo, hi, dep, fwd);
+            if (ok) ok = collect(dep, false, lo, hi, -1, back);
+            for (size_t i = 0; i < fwd.size();  i++) v[fwd[i]].seen  = false;
+            for (size_t i = 0; i < back.size(); i++) v[back[i]].seen = false;
+            if (!ok) return false;
+
+            auto cmp = [this](int a, int b) { return byOrd(a, b); };
+            sort(fwd.begin(),  fwd.end(),  cmp);
+            sort(back.begin(), back.end(), cmp);
+            vector<int> slots;
+            for (size_t i = 0; i < back.size(); i++) slots.push_back(v[back[i]].ord);
+            for (size_t i = 0; i < fwd.size();  i++) slots.push_back(v[fwd[i]].ord);
+            sort(slots.begin(), slots.end());
+            size_t k = 0;
+            for (size_t i = 0; i < back.size(); i++) v[back[i]].ord = slots[k++];
+            for (size_t i = 0; i < fwd.size();  i++) v[fwd[i]].ord  = slots[k++];
+        }
+        link(v[dep].out, task);
+        link(v[task].in, dep);
+        if (v[dep].pending) v[task].blockers++;
+        edges++;
+        return true;
+    }
+
+    bool removeEdge(int task, int dep)
+    {
+        if (!unlink(v[task].in, dep)) return false;
+        unlink(v[dep].out, task);
+        if (v[dep].pending) v[task].blockers--;
+        edges--;
+        return true;
+    }
+
+    // Removes every edge touching `id` (a deleted task) and reports them so
+    // undo can add them back. Call after resolve() so blockers stay right.
+    void detach(int id, vector<int>& dependsOn, vector<int>& dependents)
+    {
+        while (v[id].in)
+        {
+            int u = v[id].in->taskId;
+            dependsOn.push_back(u);
+            removeEdge(id, u);
+        }
+        while (v[id].out)
+        {
+            int w = v[id].out->taskId;
+            dependents.push_back(w);
+            removeEdge(w, id);
+        }
+    }
+
+    // Task was completed or deleted: pending tasks it was the last blocker
+    // of are appended to `ready`.
+    void resolve(int id, vector<int>& ready)
+    {
+        if (!v[id].pending) return;
+        v[id].pending = false;
+        for (EdgeNode* e = v[id].out; e; e = e->next)
+        {
+            Vertex& w = v[e->taskId];
+            if (--w.blockers == 0 && w.pending) ready.push_back(e->taskId);
+        }
+    }
+
+    // Deleted pending task came back via undo. It was detached on delete, so
+    // its edges are added back afterwards with addEdge.
+    void restore(int id)
+    {
+        v[id].pending = true;
+    }
+
+    ~DependencyGraph()
+    {
+        for (size_t i = 0; i < v.size(); i++)
+        {
+            while (v[i].out) { EdgeNode* t = v[i].out; v[i].out = t->next; delete t; }
+            while (v[i].in)  { EdgeNode* t = v[i].in;  v[i].in  = t->next; delete t; }
+        }
+    }
+};
+
+enum TraceOp : uint8_t
+{
+    OP_ADD = 1, OP_DONE, OP_DELETE, OP_UNDO, OP_CHANGE_PRI,
+    OP_PLAN_ADD, OP_PLAN_DONE, OP_PLAN_SKIP, OP_SUGGEST, OP_BY_PRIORITY,
+    OP_DEPEND, OP_UNDEPEND,
+    OP_COUNT
+};
+
+const char* opName(int op)
+{
+    static const char* names[OP_COUNT] = {
+        "?", "add", "done", "delete", "undo", "changePriority",
+        "planAdd", "planDone", "planSkip", "suggest", "byPriority",
+        "depend", "undepend"
+    };
+    return (op > 0 && op < OP_COUNT) ? names[op] : "?";
+}
+
+struct TraceRecord
+{
+    uint8_t  op;
+    uint64_t atMicros;     // offset from start of trace
+    int      a, b;
+    string   title;
+
+    TraceRecord() : op(0), atMicros(0), a(0), b(0) {}
+};
+
+// Binary layout: "TDTR" + version byte, then per record
+//   op:u8  dt:varint(us since previous)  args:zigzag varints  [title:len+bytes]
+class TraceRecorder
+{
+    ofstream out;
+    chrono::steady_clock::time_point start;
+    uint64_t last;
+
+    void putVarint(uint64_t v)
+    {
+        while (v >= 0x80) { out.put(char((v & 0x7f) | 0x80)); v >>= 7; }
+        out.put(char(v));
+    }
+
+    void putInt(int v)
+    {
+        int64_t x = v;
+        putVarint((uint64_t(x) << 1) ^ uint64_t(x >> 63));
+    }
+
+public:
+    explicit TraceRecorder(const string& path)
+        : out(path.c_str(), ios::binary), start(chrono::steady_clock::now()), last(0)
+    {
+        if (out) out.write("TDTR\x01", 5).flush();
+    }
+
+    bool ok() const { return (bool)out; }
+
+    void record(TraceOp op, int a = 0, int b = 0, const string& title = "")
+    {
+        uint64_t now = chrono::duration_cast<chrono::microseconds>(
+                           chrono::steady_clock::now() - start).count();
+        writeRecord(op, now - last, a, b, title);
+        last = now;
+        out.flush();    // a killed or crashed session keeps everything so far
+    }
+
+    void writeRecord(TraceOp op, uint64_t dt, int a, int b, const string& title)
+    {
+        out.put(char(op));
+        putVarint(dt);
+        switch (op)
+        {
+        case OP_ADD:
+            putInt(a);
+            putVarint(title.size());
+            out.write(title.data(), title.size());
+            break;
+        case OP_DONE: case OP_DELETE: case OP_PLAN_ADD:
+            putInt(a);
+            break;
+        case OP_CHANGE_PRI: case OP_DEPEND: case OP_UNDEPEND:
+            putInt(a); putInt(b);
+            break;
+        default: break;
+        }
+    }
+};
+
+enum TraceStatus { TRACE_OK, TRACE_END, TRACE_CORRUPT };
+
+class TraceReader
+{
+    ifstream in;
+
+    bool getVarint(uint64_t& v)
+    {
+        v = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            int c = in.get();
+            if (c == EOF) return false;
+            v |= uint64_t(c & 0x7f) << shift;
+            if (!(c & 0x80)) return true;
+        }
+        return false;
+    }
+
+    bool getInt(int& v)
+    {
+        uint64_t z;
+        if (!getVarint(z)) return false;
+        v = int(int64_t(z >> 1) ^ -int64_t(z & 1));
+        return true;
+    }
+
+public:
+    explicit TraceReader(const string& path) : in(path.c_str(), ios::binary) {}
+
+    bool open()
+    {
+        char magic[5];
+        if (!in.read(magic, 5)) return false;
+        return memcmp(magic, "TDTR\x01", 5) == 0;
+    }
+
+    // TRACE_END only at a clean record boundary; a bad op byte or a record
+    // cut short is TRACE_CORRUPT.
+    TraceStatus next(TraceRecord& r, uint64_t& clock)
+    {
+        int op = in.get();
+        if (op == EOF) return TRACE_END;
+        uint64_t dt;
+        if (op <= 0 || op >= OP_COUNT || !getVarint(dt)) return TRACE_CORRUPT;
+        r = TraceRecord();
+        r.op = uint8_t(op);
+        clock += dt;
+        r.atMicros = clock;
+        bool ok = true;
+        switch (op)
+        {
+        case OP_ADD:
+        {
+            uint64_t len;
+            ok = getInt(r.a) && getVarint(len) && len <= (1u << 20);
+            if (ok && len)
+            {
+                r.title.resize(len);
+                ok = (bool)in.read(&r.title[0], len);
+            }
+            break;
+        }
+        case OP_DONE: case OP_DELETE: case OP_PLAN_ADD:
+            ok = getInt(r.a);
+            break;
+        case OP_CHANGE_PRI: case OP_DEPEND: case OP_UNDEPEND:
+            ok = getInt(r.a) && getInt(r.b);
+            break;
+        default: break;
+        }
+        return ok ? TRACE_OK : TRACE_CORRUPT;
+    }
+};
+
 class TodoList
 {
     TaskNode*    head;
@@ -210,6 +687,10 @@ class TodoList
     UndoStack    undoStack;
     MinHeap      heap;
     PlannerQueue planner;
+    DependencyGraph deps;
+    vector<TaskNode*> byId;
+    int          pendingCount;   // ready + blocked; capped so every ready task fits the heap
+    TraceRecorder* tracer;
 
     string currentTime()
     {
@@ -222,9 +703,7 @@ class TodoList
 
     TaskNode* findById(int id)
     {
-        TaskNode* cur = head;
-        while (cur) { if (cur->id == id) return cur; cur = cur->next; }
-        return nullptr;
+        return (id > 0 && id < (int)byId.size()) ? byId[id] : nullptr;
     }
 
     bool priorityTaken(int p)
@@ -259,6 +738,8 @@ class TodoList
 
     void appendNode(TaskNode* node)
     {
+        if (node->id >= (int)byId.size()) byId.resize(node->id + 1, nullptr);
+        byId[node->id] = node;
         node->next = nullptr;
         if (!head) { head = node; return; }
         TaskNode* cur = head;
@@ -266,19 +747,35 @@ class TodoList
         cur->next = node;
     }
 
+    void releaseDependents(int id)
+    {
+        vector<int> ready;
+        deps.resolve(id, ready);
+        for (size_t i = 0; i < ready.size(); i++)
+        {
+            TaskNode* t = findById(ready[i]);
+            if (t) heap.insert(t->priority, t->id);
+        }
+    }
+
     void printDivider() { cout << "  " << string(72, '-') << "\n"; }
 
     string P(int p) { return "P" + to_string(p); }
 
 public:
-    TodoList() : head(nullptr), idCounter(1) {}
+    TodoList() : head(nullptr), idCounter(1), pendingCount(0), tracer(nullptr) {}
 
-    void addTask(const string& title, int priority)
+    void setTracer(TraceRecorder* t) { tracer = t; }
+
+    bool addTask(const string& title, int priority)
     {
+        if (tracer) tracer->record(OP_ADD, priority, 0, title);
         if (title.empty())
-            { cout << "\n   Title cannot be empty.\n"; return; }
+            { cout << "\n   Title cannot be empty.\n"; return false; }
         if (priority < 1 || priority > 10)
-            { cout << "\n  Priority must be 1-10.\n"; return; }
+            { cout << "\n  Priority must be 1-10.\n"; return false; }
+        if (pendingCount >= MinHeap::CAPACITY)
+            { cout << "\n  [!] Too many pending tasks (" << pendingCount << "). Finish some first.\n"; return false; }
 
         if (priorityTaken(priority))
         {
@@ -296,42 +793,58 @@ public:
         node->createdAt = currentTime();
 
         appendNode(node);
+        deps.addTask(node->id);
         heap.insert(priority, node->id);
+        pendingCount++;
 
         cout << "\n  [+] Task added  (ID: " << node->id
              << "  Priority: P" << node->priority << ")\n";
+        return true;
     }
 
-    void markDone(int id)
+    bool markDone(int id)
     {
+        if (tracer) tracer->record(OP_DONE, id);
         TaskNode* t = findById(id);
-        if (!t)     { cout << "\n  Task ID " << id << " not found.\n"; return; }
-        if (t->done){ cout << "\n  Task already done.\n"; return; }
+        if (!t)     { cout << "\n  Task ID " << id << " not found.\n"; return false; }
+        if (t->done){ cout << "\n  Task already done.\n"; return false; }
+        if (deps.isBlocked(id))
+            { cout << "\n  [!] Task " << id << " is blocked by unfinished dependencies.\n"; return false; }
         t->done = true;
+        pendingCount--;
         heap.removeById(id);
+        releaseDependents(id);
         if (t->inPlanner) { planner.remove(id); t->inPlanner = false; }
         cout << "\n  [v] Task " << id << " marked as done!\n";
+        return true;
     }
 
-    void deleteTask(int id)
+    bool deleteTask(int id)
     {
+        if (tracer) tracer->record(OP_DELETE, id);
         TaskNode* cur = head, *prev = nullptr;
         while (cur)
         {
             if (cur->id == id)
             {
-                undoStack.push(cur);
+                if (!cur->done) pendingCount--;
                 heap.removeById(id);
+                releaseDependents(id);
+                vector<int> dependsOn, dependents;
+                deps.detach(id, dependsOn, dependents);
+                undoStack.push(cur, dependsOn, dependents);
                 if (cur->inPlanner) planner.remove(id);
                 if (prev) prev->next = cur->next;
                 else      head       = cur->next;
+                byId[id] = nullptr;
                 delete cur;
                 cout << "\n  Task " << id << " deleted. (Undo available)\n";
-                return;
+                return true;
             }
             prev = cur; cur = cur->next;
         }
         cout << "\n  Task ID " << id << " not found.\n";
+        return false;
     }
 
     void display()
@@ -349,8 +862,9 @@ public:
         TaskNode* cur = head;
         while (cur)
         {
-            string status = cur->done      ? "[Done]"    :
-                            cur->inPlanner ? "[Planned]" : "[Todo]";
+            string status = cur->done                ? "[Done]"    :
+                            deps.isBlocked(cur->id)  ? "[Blocked]" :
+                            cur->inPlanner           ? "[Planned]" : "[Todo]";
             cout << "  "
                  << setw(5)  << cur->id
                  << setw(30) << cur->title.substr(0, 28)
@@ -372,7 +886,8 @@ public:
         {
             if (cur->title.find(keyword) != string::npos)
             {
-                string status = cur->done ? "[Done]" : "[Todo]";
+                string status = cur->done               ? "[Done]"    :
+                                deps.isBlocked(cur->id) ? "[Blocked]" : "[Todo]";
                 cout << "  ID:" << setw(4) << cur->id
                      << "  " << setw(4) << P(cur->priority)
                      << "  " << cur->title
@@ -385,12 +900,16 @@ public:
         printDivider();
     }
 
-    void undoDelete()
+    bool undoDelete()
     {
+        if (tracer) tracer->record(OP_UNDO);
         if (undoStack.isEmpty())
-            { cout << "\n  Nothing to undo.\n"; return; }
+            { cout << "\n  Nothing to undo.\n"; return false; }
+        if (!undoStack.peek()->done && pendingCount >= MinHeap::CAPACITY)
+            { cout << "\n  [!] Too many pending tasks to restore. Finish some first.\n"; return false; }
 
-        TaskNode* r  = undoStack.pop();
+        vector<int> dependsOn, dependents;
+        TaskNode* r  = undoStack.pop(&dependsOn, &dependents);
         r->next      = nullptr;
         r->inPlanner = false;
 
@@ -402,13 +921,37 @@ public:
         }
 
         appendNode(r);
-        if (!r->done) heap.insert(r->priority, r->id);
+        if (!r->done)
+        {
+            pendingCount++;
+            deps.restore(r->id);
+        }
+
+        // Dependencies added while the task was gone may now form a cycle
+        // with its old edges; those edges are dropped.
+        int dropped = 0;
+        for (size_t i = 0; i < dependsOn.size(); i++)
+            if (findById(dependsOn[i]) && !deps.addEdge(r->id, dependsOn[i])) dropped++;
+        for (size_t i = 0; i < dependents.size(); i++)
+        {
+            TaskNode* w = findById(dependents[i]);
+            if (!w) continue;
+            if (!deps.addEdge(w->id, r->id)) dropped++;
+            else if (!w->done && !r->done) heap.removeById(w->id);
+        }
+        if (!r->done && !deps.isBlocked(r->id)) heap.insert(r->priority, r->id);
+
         cout << "\n  \"" << r->title
              << "\" restored at P" << r->priority << "!\n";
+        if (dropped)
+            cout << "  [!] " << dropped
+                 << " of its dependencies would now form a cycle and were not restored.\n";
+        return true;
     }
 
     void suggestNext()
     {
+        if (tracer) tracer->record(OP_SUGGEST);
         if (heap.isEmpty())
             { cout << "\n  Great job! No pending tasks left.\n"; return; }
 
@@ -428,10 +971,11 @@ public:
 
     void displayByPriority()
     {
-        HeapEntry sorted[500]; int sz = 0;
+        if (tracer) tracer->record(OP_BY_PRIORITY);
+        HeapEntry sorted[MinHeap::CAPACITY]; int sz = 0;
         heap.sortedSnapshot(sorted, sz);
 
-        cout << "\n  Tasks sorted by Priority (pending only):\n";
+        cout << "\n  Tasks sorted by Priority (pending, unblocked only):\n";
         printDivider();
         cout << "  " << left
              << setw(6)  << "PRI"
@@ -455,12 +999,13 @@ public:
         printDivider();
     }
 
-    void changePriority(int id, int newP)
+    bool changePriority(int id, int newP)
     {
+        if (tracer) tracer->record(OP_CHANGE_PRI, id, newP);
         TaskNode* t = findById(id);
-        if (!t)      { cout << "\n  Task ID " << id << " not found.\n"; return; }
-        if (t->done) { cout << "\n   Cannot change priority of a done task.\n"; return; }
-        if (newP < 1 || newP > 10) { cout << "\n  [!] Priority must be 1-10.\n"; return; }
+        if (!t)      { cout << "\n  Task ID " << id << " not found.\n"; return false; }
+        if (t->done) { cout << "\n   Cannot change priority of a done task.\n"; return false; }
+        if (newP < 1 || newP > 10) { cout << "\n  [!] Priority must be 1-10.\n"; return false; }
 
         int oldP = t->priority;
         t->priority = 999;
@@ -476,23 +1021,26 @@ public:
         heap.updatePriority(id, newP);
         cout << "\n  [*] Task " << id
              << "  P" << oldP << " -> P" << newP << "\n";
+        return true;
     }
 
-    void addToPlanner(int id)
+    bool addToPlanner(int id)
     {
+        if (tracer) tracer->record(OP_PLAN_ADD, id);
         TaskNode* t = findById(id);
-        if (!t)           { cout << "\n   Task ID " << id << " not found.\n"; return; }
-        if (t->done)      { cout << "\n  Cannot plan a completed task.\n"; return; }
-        if (t->inPlanner) { cout << "\n   Task already in today's planner.\n"; return; }
-
-        if (planner.enqueue(id))
-        {
-            t->inPlanner = true;
-            cout << "\n  \"" << t->title
-                 << "\" added to planner  (Queue position: "
-                 << planner.size() << ")\n";
-        }
-        else cout << "\n  Planner is full.\n";
+        if (!t)           { cout << "\n   Task ID " << id << " not found.\n"; return false; }
+        if (t->done)      { cout << "\n  Cannot plan a completed task.\n"; return false; }
+        if (deps.isBlocked(id))
+            { cout << "\n  [!] Task " << id << " is blocked by unfinished dependencies.\n"; return false; }
+        if (t->inPlanner) { cout << "\n   Task already in today's planner.\n"; return false; }
+
+        if (!planner.enqueue(id))
+            { cout << "\n  Planner is full.\n"; return false; }
+        t->inPlanner = true;
+        cout << "\n  \"" << t->title
+             << "\" added to planner  (Queue position: "
+             << planner.size() << ")\n";
+        return true;
     }
 
     void displayPlanner()
@@ -513,7 +1061,8 @@ public:
         {
             cout << "  FOCUS NOW  ->  P" << current->priority
                  << "  [ID:" << current->id << "]  "
-                 << current->title << "\n";
+                 << current->title
+                 << (deps.isBlocked(current->id) ? "  (blocked)" : "") << "\n";
             printDivider();
         }
 
@@ -525,15 +1074,23 @@ public:
             if (t)
                 cout << "  " << setw(3) << (i + 1) << ".  P"
                      << t->priority << "  [ID:" << t->id << "]  "
-                     << t->title << "\n";
+                     << t->title
+                     << (deps.isBlocked(t->id) ? "  (blocked)" : "") << "\n";
         }
         printDivider();
     }
 
-    void plannerDoneNext()
+    bool plannerDoneNext()
     {
+        if (tracer) tracer->record(OP_PLAN_DONE);
         if (planner.isEmpty())
-            { cout << "\n  Planner is empty.\n"; return; }
+            { cout << "\n  Planner is empty.\n"; return false; }
+        if (deps.isBlocked(planner.peek()))
+        {
+            cout << "\n  [!] Task " << planner.peek()
+                 << " is blocked by unfinished dependencies. Skip it for now.\n";
+            return false;
+        }
 
         int id        = planner.dequeue();
         TaskNode* t   = findById(id);
@@ -541,7 +1098,9 @@ public:
         {
             t->done      = true;
             t->inPlanner = false;
+            pendingCount--;
             heap.removeById(id);
+            releaseDependents(id);
             cout << "\n   \"" << t->title << "\" marked done!\n";
         }
 
@@ -553,14 +1112,16 @@ public:
                      << "  \"" << next->title << "\"\n";
         }
         else cout << "  [*] Planner complete for today!\n";
+        return true;
     }
 
-    void plannerSkip()
+    bool plannerSkip()
     {
+        if (tracer) tracer->record(OP_PLAN_SKIP);
         if (planner.isEmpty())
-            { cout << "\n Planner is empty.\n"; return; }
+            { cout << "\n Planner is empty.\n"; return false; }
         if (planner.size() == 1)
-            { cout << "\n  [Only one task -- cannot skip.\n"; return; }
+            { cout << "\n  [Only one task -- cannot skip.\n"; return false; }
 
         int id = planner.dequeue();
         planner.enqueue(id);   
@@ -571,6 +1132,38 @@ public:
         if (next)
             cout << "\n  Skipped. Next up: P" << next->priority
                  << "  \"" << next->title << "\"\n";
+        return true;
+    }
+
+    bool addDependency(int id, int depId)
+    {
+        if (tracer) tracer->record(OP_DEPEND, id, depId);
+        TaskNode* t = findById(id);
+        TaskNode* d = findById(depId);
+        if (!t) { cout << "\n  Task ID " << id    << " not found.\n"; return false; }
+        if (!d) { cout << "\n  Task ID " << depId << " not found.\n"; return false; }
+        if (deps.hasEdge(id, depId))
+            { cout << "\n  Task " << id << " already depends on " << depId << ".\n"; return false; }
+        if (!deps.addEdge(id, depId))
+            { cout << "\n  [!] That would create a dependency cycle.\n"; return false; }
+
+        if (!t->done && !d->done) heap.removeById(id);
+        cout << "\n  [>] Task " << id << " now depends on task " << depId
+             << (deps.isBlocked(id) && !t->done ? "  (blocked)" : "") << "\n";
+        return true;
+    }
+
+    bool removeDependency(int id, int depId)
+    {
+        if (tracer) tracer->record(OP_UNDEPEND, id, depId);
+        TaskNode* t = findById(id);
+        if (!t || !findById(depId) || !deps.removeEdge(id, depId))
+            { cout << "\n  Task " << id << " does not depend on " << depId << ".\n"; return false; }
+
+        if (!t->done && !deps.isBlocked(id) && !heap.contains(id))
+            heap.insert(t->priority, id);
+        cout << "\n  [<] Task " << id << " no longer depends on task " << depId << "\n";
+        return true;
     }
 
     void showStats()
@@ -588,7 +1181,9 @@ public:
         cout << "  Completed         : " << done          << "\n";
         cout << "  Pending           : " << pending       << "\n";
         cout << "  In planner today  : " << planner.size()<< "\n";
-        cout << "  In heap (pending) : " << heap.size()   << "\n";
+        cout << "  Ready (in heap)   : " << heap.size()   << "\n";
+        cout << "  Blocked           : " << deps.blockedCount() << "\n";
+        cout << "  Dependencies      : " << deps.edgeCount()    << "\n";
         cout << "  " << string(40, '-') << "\n";
     }
 
@@ -599,12 +1194,888 @@ public:
     }
 };
 
+struct NullBuffer : streambuf
+{
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+void applyOp(TodoList& list, const TraceRecord& r)
+{
+    switch (r.op)
+    {
+    case OP_ADD:         list.addTask(r.title, r.a);     break;
+    case OP_DONE:        list.markDone(r.a);             break;
+    case OP_DELETE:      list.deleteTask(r.a);           break;
+    case OP_UNDO:        list.undoDelete();              break;
+    case OP_CHANGE_PRI:  list.changePriority(r.a, r.b);  break;
+    case OP_PLAN_ADD:    list.addToPlanner(r.a);         break;
+    case OP_PLAN_DONE:   list.plannerDoneNext();         break;
+    case OP_PLAN_SKIP:   list.plannerSkip();             break;
+    case OP_SUGGEST:     list.suggestNext();             break;
+    case OP_BY_PRIORITY: list.displayByPriority();       break;
+    case OP_DEPEND:      list.addDependency(r.a, r.b);   break;
+    case OP_UNDEPEND:    list.removeDependency(r.a, r.b);break;
+    }
+}
+
+long peakMemoryKB()
+{
+#ifndef _WIN32
+    rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0) return ru.ru_maxrss;
+#endif
+    return -1;
+}
+
+int replayTrace(const string& path, bool paced)
+{
+    TraceReader reader(path);
+    if (!reader.open())
+        { cout << "\n  [!] " << path << " is not a trace file.\n"; return 1; }
+
+    // Records are streamed one at a time so the replayer's own footprint
+    // stays out of the memory figure; only the latency samples accumulate.
+    vector<vector<uint64_t> > lat(OP_COUNT);
+    TodoList    list;
+    NullBuffer  sink;
+    TraceRecord r;
+    uint64_t    clock = 0;
+    size_t      count = 0;
+    TraceStatus st;
+    long        baseKB = peakMemoryKB();
+    streambuf*  saved  = cout.rdbuf(&sink);
+
+    auto start = chrono::steady_clock::now();
+    while ((st = reader.next(r, clock)) == TRACE_OK)
+    {
+        if (paced)
+            this_thread::sleep_until(start + chrono::microseconds(r.atMicros));
+        auto t0 = chrono::steady_clock::now();
+        applyOp(list, r);
+        auto t1 = chrono::steady_clock::now();
+        lat[r.op].push_back(
+            chrono::duration_cast<chrono::nanoseconds>(t1 - t0).count());
+        count++;
+    }
+    double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout.rdbuf(saved);
+
+    bool partial = (st == TRACE_CORRUPT);
+    if (partial)
+        cout << "\n  [!] Record " << count
+             << " is truncated or corrupt; only the " << count
+             << " records before it were replayed.\n";
+
+    cout << "\n  Replay of " << path << (paced ? "  (original pacing)" : "  (full speed)")
+         << (partial ? "  [PARTIAL - trace corrupt]" : "") << "\n";
+    cout << "  " << string(72, '-') << "\n";
+    cout << "  Operations        : " << count << "\n";
+    cout << "  Elapsed           : " << fixed << setprecision(3) << secs << " s\n";
+    cout << "  Throughput        : " << setprecision(0)
+         << (secs > 0 ? count / secs : 0.0) << " ops/s\n";
+    long kb = peakMemoryKB();
+    if (kb >= 0 && baseKB >= 0)
+        cout << "  Peak memory (RSS) : " << kb << " KB  (+" << kb - baseKB
+             << " KB during replay, incl. " << count * 8 / 1024 << " KB of latency samples)\n";
+    else
+        cout << "  Peak memory (RSS) : n/a\n";
+    cout << "  " << string(72, '-') << "\n";
+    cout << "  " << left << setw(16) << "OP" << right
+         << setw(10) << "COUNT" << setw(11) << "p50 us" << setw(11) << "p90 us"
+         << setw(11) << "p99 us" << setw(11) << "max us" << "\n";
+    cout << "  " << string(72, '-') << "\n";
+    cout << setprecision(2);
+    for (int op = 1; op < OP_COUNT; op++)
+    {
+        vector<uint64_t>& v = lat[op];
+        if (v.empty()) continue;
+        sort(v.begin(), v.end());
+        size_t n = v.size();
+        cout << "  " << left << setw(16) << opName(op) << right
+             << setw(10) << n
+             << setw(11) << v[(n - 1) * 50 / 100] / 1000.0
+             << setw(11) << v[(n - 1) * 90 / 100] / 1000.0
+             << setw(11) << v[(n - 1) * 99 / 100] / 1000.0
+             << setw(11) << v[n - 1] / 1000.0 << "\n";
+    }
+    cout << "  " << string(72, '-') << "\n" << left;
+    return partial ? 1 : 0;
+}
+
+// Synthetic workloads. IDs are predicted from the add order, which matches
+// TodoList as long as every generated add is valid. Pending tasks are kept
+// well under the heap's capacity by completing tasks when the list grows.
+int generateTrace(const string& mix, int count, const string& path, unsigned seed)
+{
+    bool cascade = (mix == "cascade"), depend = (mix == "depend");
+    if (!cascade && !depend && mix != "planner")
+        { cout << "\n  [!] Unknown mix \"" << mix << "\" (cascade | planner | depend).\n"; return 1; }
+
+    TraceRecorder rec(path);
+    if (!rec.ok()) { cout << "\n  [!] Cannot write " << path << ".\n"; return 1; }
+
+    mt19937 rng(seed);
+    auto roll = [&](int n) { return int(rng() % n); };
+    vector<int> pending, deleted, queue;
+    int nextId = 1;
+    const uint64_t step = 1000;
+
+    auto takeRandom = [&](vector<int>& v) {
+        int i = roll(v.size()), id = v[i];
+        v[i] = v.back(); v.pop_back();
+        return id;
+    };
+
+    for (int i = 0; i < count; i++)
+    {
+        int r = roll(100);
+        if (pending.size() + queue.size() > 300) r = cascade ? 75 : depend ? 92 : 93;
+
+        if (depend && !pending.empty() && r >= 15)
+        {
+            // Random endpoints among every task created so far; some edges
+            // close cycles and exercise the rejection path.
+            if (r < 90)
+                rec.writeRecord(OP_DEPEND, step, 1 + roll(nextId - 1), 1 + roll(nextId - 1), "");
+            else if (r < 97)
+                rec.writeRecord(OP_DONE, step, takeRandom(pending), 0, "");
+            else
+                rec.writeRecord(OP_SUGGEST, step, 0, 0, "");
+        }
+        else if (pending.empty() || (cascade ? r < 45 : r < 25))
+        {
+            int p = cascade ? 1 + roll(3) : 1 + roll(10);
+            rec.writeRecord(OP_ADD, step, p, 0, "task " + to_string(nextId));
+            pending.push_back(nextId++);
+        }
+        else if (cascade)
+        {
+            if (r < 70)
+                rec.writeRecord(OP_CHANGE_PRI, step, pending[roll(pending.size())], 1 + roll(4), "");
+            else if (r < 88)
+                rec.writeRecord(OP_DONE, step, takeRandom(pending), 0, "");
+            else if (r < 94)
+            {
+                int id = takeRandom(pending);
+                rec.writeRecord(OP_DELETE, step, id, 0, "");
+                deleted.push_back(id);
+            }
+            else if (!deleted.empty())
+            {
+                rec.writeRecord(OP_UNDO, step, 0, 0, "");
+                pending.push_back(deleted.back()); deleted.pop_back();
+            }
+            else rec.writeRecord(OP_SUGGEST, step, 0, 0, "");
+        }
+        else
+        {
+            if (r < 55 && queue.size() < 90)
+            {
+                int id = takeRandom(pending);
+                rec.writeRecord(OP_PLAN_ADD, step, id, 0, "");
+                queue.push_back(id);
+            }
+            else if (r < 80 && !queue.empty())
+            {
+                rec.writeRecord(OP_PLAN_DONE, step, 0, 0, "");
+                queue.erase(queue.begin());
+            }
+            else if (r < 92 && queue.size() > 1)
+            {
+                rec.writeRecord(OP_PLAN_SKIP, step, 0, 0, "");
+                rotate(queue.begin(), queue.begin() + 1, queue.end());
+            }
+            else if (r < 96)
+                rec.writeRecord(OP_DONE, step, takeRandom(pending), 0, "");
+            else
+                rec.writeRecord(OP_SUGGEST, step, 0, 0, "");
+        }
+    }
+    cout << "\n  Wrote " << count << " " << mix << " ops to " << path << "\n";
+    return 0;
+}
+
+// Op streams are generated up front so the RNG stays out of the timed loop.
+// insert-heavy: grow towards n with 70% inserts / 30% pop-min (add + done).
+// update-heavy: n live tasks, 80% updates, 10% removes, 10% inserts.
+vector<HeapBenchOp> heapBenchOps(bool updateHeavy, int n, int ops, unsigned seed)
+{
+    mt19937 rng(seed);
+    vector<HeapBenchOp> out;
+    vector<int> live;
+    int nextId = 1, size = 0;
+
+    if (updateHeavy)
+        for (; size < n; size++)
+        {
+            out.push_back({'i', nextId, 1 + int(rng() % 10)});
+            live.push_back(nextId++);
+        }
+
+    for (int i = 0; i < ops; i++)
+    {
+        int r = rng() % 100;
+        if (!updateHeavy)
+        {
+            if (size == 0 || (r < 70 && size < n))
+                { out.push_back({'i', nextId++, 1 + int(rng() % 10)}); size++; }
+            else
+                { out.push_back({'p', 0, 0}); size--; }
+        }
+        else if (r < 80 && !live.empty())
+            out.push_back({'u', live[rng() % live.size()], 1 + int(rng() % 10)});
+        else if (r < 90 && !live.empty())
+        {
+            int k = rng() % live.size();
+            out.push_back({'r', live[k], 0});
+            live[k] = live.back(); live.pop_back();
+        }
+        else if ((int)live.size() < n)
+        {
+            out.push_back({'i', nextId, 1 + int(rng() % 10)});
+            live.push_back(nextId++);
+        }
+    }
+    return out;
+}
+
+template <int D>
+double benchHeap(const vector<HeapBenchOp>& ops, long long& checksum)
+{
+    typedef DaryHeap<D, int, less<int>, TieById, 1 << 16> Heap;
+    double best = 1e18;
+    for (int rep = 0; rep < 3; rep++)
+    {
+        Heap* h = new Heap();
+        auto t0 = chrono::steady_clock::now();
+        for (size_t i = 0; i < ops.size(); i++)
+        {
+            const HeapBenchOp& op = ops[i];
+            switch (op.kind)
+            {
+            case 'i': h->insert(op.key, op.id); break;
+            case 'u': h->updatePriority(op.id, op.key); break;
+            case 'r': h->removeById(op.id); break;
+            case 'p': h->removeById(h->peekMin().taskId); break;
+            }
+            if (!h->isEmpty()) checksum += h->peekMin().taskId;
+        }
+        double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count();
+        best = min(best, ns / ops.size());
+        delete h;
+    }
+    return best;
+}
+
+// Replays a trace with the heap calls logged; returns false if unreadable.
+bool captureHeapOps(const string& path, vector<HeapBenchOp>& out)
+{
+    TraceReader reader(path);
+    if (!reader.open()) return false;
+
+    TodoList    list;
+    NullBuffer  sink;
+    TraceRecord r;
+    uint64_t    clock = 0;
+    MinHeap::opLog = &out;
+    streambuf* saved = cout.rdbuf(&sink);
+    while (reader.next(r, clock) == TRACE_OK) applyOp(list, r);
+    cout.rdbuf(saved);
+    MinHeap::opLog = nullptr;
+    return true;
+}
+
+void benchRow(const string& label, int n, const vector<HeapBenchOp>& stream,
+              long long& checksum, double* total)
+{
+    double t[3] = { benchHeap<2>(stream, checksum),
+                    benchHeap<4>(stream, checksum),
+                    benchHeap<8>(stream, checksum) };
+    int best = int(min_element(t, t + 3) - t);
+    cout << "  " << left << setw(16) << label.substr(0, 15)
+         << setw(8) << n << right << fixed << setprecision(1)
+         << setw(10) << t[0] << setw(10) << t[1] << setw(10) << t[2]
+         << setw(10) << ("D=" + to_string(2 << best)) << "\n";
+    if (total)
+        for (int k = 0; k < 3; k++) total[k] += t[k] * stream.size();
+}
+
+// Without traces: synthetic insert-heavy / update-heavy mixes. With traces:
+// the heap calls TodoList issues while replaying them, and a total weighted
+// by each trace's heap op count, which is what TODO_HEAP_ARITY is set from.
+int benchHeaps(int ops, const vector<string>& traces)
+{
+    long long checksum = 0;
+
+    cout << "\n  D-ary heap benchmark  (ns/op, best of 3)\n";
+    cout << "  " << string(72, '-') << "\n";
+    cout << "  " << left << setw(16) << "MIX" << setw(8) << "OPS" << right
+         << setw(10) << "D=2" << setw(10) << "D=4" << setw(10) << "D=8"
+         << setw(10) << "BEST" << "\n";
+    cout << "  " << string(72, '-') << "\n";
+
+    if (traces.empty())
+    {
+        const int sizes[] = { MinHeap::CAPACITY, 50000 };
+        for (int mix = 0; mix < 2; mix++)
+            for (int s = 0; s < 2; s++)
+                benchRow(string(mix ? "update" : "insert") + " N=" + to_string(sizes[s]),
+                         ops, heapBenchOps(mix == 1, sizes[s], ops, 7), checksum, nullptr);
+    }
+    else
+    {
+        double total[3] = { 0, 0, 0 };
+        size_t allOps   = 0;
+        for (size_t i = 0; i < traces.size(); i++)
+        {
+            vector<HeapBenchOp> stream;
+            if (!captureHeapOps(traces[i], stream) || stream.empty())
+                { cout << "  [!] No heap ops from " << traces[i] << "\n"; continue; }
+            string name = traces[i].substr(traces[i].find_last_of("/\\") + 1);
+            benchRow(name, stream.size(), stream, checksum, total);
+            allOps += stream.size();
+        }
+        if (allOps)
+        {
+            for (int k = 0; k < 3; k++) total[k] /= allOps;
+            int best = int(min_element(total, total + 3) - total);
+            cout << "  " << string(72, '-') << "\n";
+            cout << "  " << left << setw(16) << "weighted" << setw(8) << allOps << right
+                 << setprecision(1) << setw(10) << total[0] << setw(10) << total[1]
+                 << setw(10) << total[2] << setw(10) << ("D=" + to_string(2 << best)) << "\n";
+        }
+    }
+    cout << "  " << string(72, '-') << "\n" << left;
+    cout << "  TodoList uses D=" << TODO_HEAP_ARITY
+         << "  (checksum " << checksum % 1000 << ")\n";
+    return 0;
+}
+
+#ifdef __linux__
+// Daemon mode: one epoll loop serves every client of a shared TodoList over a
+// Unix domain socket. Requests are text lines, e.g.
+//   ADD <pri> <title> | DONE <id> | DEL <id> | UNDO | PRI <id> <pri>
+//   PLAN <id> | PDONE | SKIP | NEXT | SORTED | LIST | PLANNER | STATS
+//   DEP <id> <dep> | UNDEP <id> <dep> | FIND <keyword> | QUIT
+// and each reply is "OK <len>\n" or "ERR <len>\n" followed by <len> bytes of
+// the text the menu would have printed. ERR means the command was unknown or
+// the operation was rejected (bad ID or priority, cycle, full queue...).
+// A line may be at most MAX_LINE (64 KiB) bytes; a longer line, or a partial
+// line left at EOF, gets an ERR reply and the connection is closed after it.
+// Pipelined lines are run in slices of MAX_LINES per wakeup, round-robin
+// with other clients, and a client stops being read while more than
+// HIGH_WATER bytes of its replies are unsent. The queued header/body strings
+// go out with writev instead of being joined.
+
+enum CommandResult { CMD_OK, CMD_FAILED, CMD_UNKNOWN };
+
+CommandResult runCommand(TodoList& list, const string& line)
+{
+    istringstream in(line);
+    string cmd;
+    int  a = 0, b = 0;
+    bool ok = true;
+    in >> cmd;
+
+    if (cmd == "ADD")
+    {
+        string title;
+        in >> a; getline(in, title);
+        size_t s = title.find_first_not_of(' ');
+        ok = list.addTask(s == string::npos ? "" : title.substr(s), a);
+    }
+    else if (cmd == "DONE")    { in >> a; ok = list.markDone(a); }
+    else if (cmd == "DEL")     { in >> a; ok = list.deleteTask(a); }
+    else if (cmd == "UNDO")    ok = list.undoDelete();
+    else if (cmd == "PRI")     { in >> a >> b; ok = list.changePriority(a, b); }
+    else if (cmd == "PLAN")    { in >> a; ok = list.addToPlanner(a); }
+    else if (cmd == "PDONE")   ok = list.plannerDoneNext();
+    else if (cmd == "SKIP")    ok = list.plannerSkip();
+    else if (cmd == "NEXT")    list.suggestNext();
+    else if (cmd == "SORTED")  list.displayByPriority();
+    else if (cmd == "LIST")    list.display();
+    else if (cmd == "PLANNER") list.displayPlanner();
+    else if (cmd == "STATS")   list.showStats();
+    else if (cmd == "DEP")     { in >> a >> b; ok = list.addDependency(a, b); }
+    else if (cmd == "UNDEP")   { in >> a >> b; ok = list.removeDependency(a, b); }
+    else if (cmd == "FIND")
+    {
+        string kw;
+        getline(in, kw);
+        size_t s = kw.find_first_not_of(' ');
+        list.search(s == string::npos ? "" : kw.substr(s));
+    }
+    else return CMD_UNKNOWN;
+    return ok ? CMD_OK : CMD_FAILED;
+}
+
+void raiseFdLimit()
+{
+    rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max)
+    {
+        rl.rlim_cur = rl.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &rl);
+    }
+}
+
+void setNonBlocking(int fd)
+{
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+bool unixAddress(const string& path, sockaddr_un& addr)
+{
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) return false;
+    memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+volatile sig_atomic_t stopServer = 0;
+
+void onStopSignal(int) { stopServer = 1; }
+
+class TodoServer
+{
+    struct Conn
+    {
+        int           fd;
+        string        in;
+        deque<string> out;
+        size_t        outOff;     // bytes of out.front() already sent
+        size_t        queued;     // bytes in out
+        uint32_t      events;     // what epoll is currently watching for
+        bool          closing;    // close once everything received is answered
+        bool          paused;     // too much unsent output; not running lines
+        bool          hasLines;   // complete lines still waiting in `in`
+        bool          inBacklog;
+
+        Conn(int f) : fd(f), outOff(0), queued(0), events(EPOLLIN), closing(false),
+                      paused(false), hasLines(false), inBacklog(false) {}
+    };
+
+    static const size_t MAX_LINE   = 64 * 1024;   // also the read-ahead limit
+    static const size_t HIGH_WATER = 1024 * 1024;
+    static const size_t LOW_WATER  = 256 * 1024;
+    static const int    MAX_LINES  = 64;
+    static const int    MAX_IOV    = 64;
+
+    TodoList&     list;
+    int           listenFd, ep;
+    vector<Conn*> conns;
+    vector<int>   backlog;    // connections with lines left after their slice
+    int           live;
+    stringbuf     capture;
+
+    void schedule(Conn* c)
+    {
+        if (c->inBacklog) return;
+        c->inBacklog = true;
+        backlog.push_back(c->fd);
+    }
+
+    void watch(Conn* c)
+    {
+        uint32_t want = 0;
+        if (!c->closing && !c->paused && c->in.size() < MAX_LINE) want |= EPOLLIN;
+        if (!c->out.empty())  want |= EPOLLOUT;
+        if (want == c->events) return;
+        epoll_event ev = {};
+        ev.events  = want;
+        ev.data.fd = c->fd;
+        epoll_ctl(ep, EPOLL_CTL_MOD, c->fd, &ev);
+        c->events = want;
+    }
+
+    void closeConn(Conn* c)
+    {
+        epoll_ctl(ep, EPOLL_CTL_DEL, c->fd, nullptr);
+        close(c->fd);
+        conns[c->fd] = nullptr;
+        delete c;
+        live--;
+    }
+
+    void acceptAll()
+    {
+        while (true)
+        {
+            int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) return;
+            if (fd >= (int)conns.size()) conns.resize(fd + 1, nullptr);
+            conns[fd] = new Conn(fd);
+            live++;
+            epoll_event ev = {};
+            ev.events  = EPOLLIN;
+            ev.data.fd = fd;
+            epoll_ctl(ep, EPOLL_CTL_ADD, fd, &ev);
+        }
+    }
+
+    void reply(Conn* c, bool ok)
+    {
+        string body = capture.str();
+        capture.str("");
+        c->out.push_back((ok ? "OK " : "ERR ") + to_string(body.size()) + "\n");
+        c->queued += c->out.back().size() + body.size();
+        if (!body.empty()) c->out.push_back(std::move(body));
+    }
+
+    // Returns false once the connection has been closed.
+    bool flush(Conn* c)
+    {
+        while (!c->out.empty())
+        {
+            iovec iov[MAX_IOV];
+            int   n = 0;
+            for (deque<string>::iterator it = c->out.begin();
+                 it != c->out.end() && n < MAX_IOV; ++it, ++n)
+            {
+                size_t off = n == 0 ? c->outOff : 0;
+                iov[n].iov_base = const_cast<char*>(it->data()) + off;
+                iov[n].iov_len  = it->size() - off;
+            }
+            ssize_t w = writev(c->fd, iov, n);
+            if (w < 0)
+            {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+                closeConn(c);
+                return false;
+            }
+            // Zero-length entries are popped even when nothing was written.
+            size_t left = w;
+            while (!c->out.empty() && left >= c->out.front().size() - c->outOff)
+            {
+                left -= c->out.front().size() - c->outOff;
+                c->queued -= c->out.front().size();
+                c->out.pop_front();
+                c->outOff = 0;
+            }
+            c->outOff += left;
+        }
+        if (c->paused && c->queued < LOW_WATER)
+        {
+            c->paused = false;
+            if (c->hasLines) schedule(c);
+        }
+        if (c->out.empty() && c->closing && !c->hasLines) { closeConn(c); return false; }
+        watch(c);
+        return true;
+    }
+
+    void readFrom(Conn* c)
+    {
+        char buf[16 * 1024];
+        while (c->in.size() < MAX_LINE)
+        {
+            ssize_t r = read(c->fd, buf, sizeof(buf));
+            if (r > 0) { c->in.append(buf, r); continue; }
+            if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+            if (r < 0) { closeConn(c); return; }
+            c->closing = true;      // peer finished sending; answer what it sent
+            break;
+        }
+        if (!c->inBacklog) serve(c);
+        else               watch(c);
+    }
+
+    // Runs at most MAX_LINES complete lines, fewer if the reply queue passes
+    // HIGH_WATER; anything left over waits for the backlog or for flush.
+    void serve(Conn* c)
+    {
+        streambuf* saved = cout.rdbuf(&capture);
+        size_t start = 0, nl = string::npos;
+        for (int handled = 0; !c->paused && handled < MAX_LINES; handled++)
+        {
+            if ((nl = c->in.find('\n', start)) == string::npos) break;
+            string line = c->in.substr(start, nl - start);
+            start = nl + 1;
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (line == "QUIT") { c->closing = true; start = c->in.size(); break; }
+            CommandResult res = runCommand(list, line);
+            if (res == CMD_UNKNOWN) cout << "unknown command: " << line << "\n";
+            reply(c, res == CMD_OK);
+            if (c->queued > HIGH_WATER) c->paused = true;
+        }
+        cout.rdbuf(saved);
+        c->in.erase(0, start);
+
+        c->hasLines = c->in.find('\n') != string::npos;
+        if (!c->hasLines && (c->in.size() >= MAX_LINE || (c->closing && !c->in.empty())))
+        {
+            // Unusable input: say why, then close once the reply is out.
+            capture.str(c->in.size() >= MAX_LINE
+                        ? "line too long (limit " + to_string(MAX_LINE) + " bytes)\n"
+                        : string("incomplete line (missing newline before EOF)\n"));
+            reply(c, false);
+            c->in.clear();
+            c->closing = true;
+        }
+        if (c->hasLines && !c->paused) schedule(c);
+        flush(c);
+    }
+
+public:
+    TodoServer(TodoList& l) : list(l), listenFd(-1), ep(-1), live(0) {}
+
+    // Only a stale socket (nothing accepting on it) is replaced; any other
+    // file, or a live server, makes this fail with the reason in `why`.
+    bool listenOn(const string& path, string& why)
+    {
+        sockaddr_un addr;
+        if (!unixAddress(path, addr)) { why = "socket path too long"; return false; }
+
+        struct stat st;
+        if (lstat(path.c_str(), &st) == 0)
+        {
+            if (!S_ISSOCK(st.st_mode)) { why = "file exists and is not a socket"; return false; }
+            int  probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            bool stale = probe >= 0 && connect(probe, (sockaddr*)&addr, sizeof(addr)) < 0
+                         && errno == ECONNREFUSED;
+            if (probe >= 0) close(probe);
+            if (!stale) { why = "another server is already using this socket"; return false; }
+            unlink(path.c_str());
+        }
+
+        listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listenFd < 0
+            || bind(listenFd, (sockaddr*)&addr, sizeof(addr)) < 0
+            || listen(listenFd, SOMAXCONN) < 0
+            || (ep = epoll_create1(EPOLL_CLOEXEC)) < 0)
+            { why = strerror(errno); return false; }
+
+        epoll_event ev = {};
+        ev.events  = EPOLLIN;
+        ev.data.fd = listenFd;
+        if (epoll_ctl(ep, EPOLL_CTL_ADD, listenFd, &ev) < 0) { why = strerror(errno); return false; }
+        return true;
+    }
+
+    void run()
+    {
+        const int   MAX_EVENTS = 1024;
+        epoll_event events[MAX_EVENTS];
+        while (!stopServer)
+        {
+            int n = epoll_wait(ep, events, MAX_EVENTS, backlog.empty() ? -1 : 0);
+            for (int i = 0; i < n; i++)
+            {
+                int fd = events[i].data.fd;
+                if (fd == listenFd) { acceptAll(); continue; }
+                Conn* c = fd < (int)conns.size() ? conns[fd] : nullptr;
+                if (!c) continue;
+                if ((events[i].events & EPOLLOUT) && !flush(c)) continue;
+                if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) readFrom(c);
+            }
+
+            vector<int> slice;
+            slice.swap(backlog);
+            for (size_t i = 0; i < slice.size(); i++)
+            {
+                Conn* c = conns[slice[i]];
+                if (!c || !c->inBacklog) continue;
+                c->inBacklog = false;
+                serve(c);
+            }
+        }
+    }
+
+    ~TodoServer()
+    {
+        for (size_t i = 0; i < conns.size(); i++)
+            if (conns[i]) { close(conns[i]->fd); delete conns[i]; }
+        if (ep >= 0)       close(ep);
+        if (listenFd >= 0) close(listenFd);
+    }
+};
+
+int serveSocket(const string& path)
+{
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT,  onStopSignal);
+    signal(SIGTERM, onStopSignal);
+    raiseFdLimit();
+
+    TodoList   list;
+    TodoServer server(list);
+    string why;
+    if (!server.listenOn(path, why))
+        { cout << "  [!] Cannot listen on " << path << ": " << why << "\n"; return 1; }
+    cout << "  Serving on " << path << "  (Ctrl-C to stop)\n" << flush;
+    server.run();
+    unlink(path.c_str());
+    cout << "\n  Server stopped.\n";
+    return 0;
+}
+
+// Load generator: opens `clients` sessions at once and keeps `depth`
+// requests in flight on each until `requests` have completed per session.
+int loadTest(const string& path, int clients, int requests, int depth)
+{
+    struct Session
+    {
+        int    fd;
+        int    sent, done, batchLeft;
+        string in, out;
+        chrono::steady_clock::time_point batchStart;
+    };
+
+    signal(SIGPIPE, SIG_IGN);
+    raiseFdLimit();
+    sockaddr_un addr;
+    if (!unixAddress(path, addr) || clients < 1 || requests < 1 || depth < 1)
+        { cout << "  [!] Bad load-test arguments.\n"; return 1; }
+
+    auto dial = [&]() {
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) { close(fd); fd = -1; }
+        return fd;
+    };
+
+    // Seed a small working set so the mix hits real tasks.
+    int seedFd = dial();
+    if (seedFd < 0)
+        { cout << "  [!] Cannot connect to " << path << ": " << strerror(errno) << "\n"; return 1; }
+    string seed;
+    for (int i = 1; i <= 64; i++) seed += "ADD " + to_string(1 + i % 10) + " load task " + to_string(i) + "\n";
+    seed += "QUIT\n";
+    if (write(seedFd, seed.data(), seed.size()) < 0) {}
+    char sink[4096];
+    while (read(seedFd, sink, sizeof(sink)) > 0) {}
+    close(seedFd);
+
+    vector<Session> sessions(clients);
+    int ep = epoll_create1(EPOLL_CLOEXEC);
+    auto connectStart = chrono::steady_clock::now();
+    for (int i = 0; i < clients; i++)
+    {
+        Session& s = sessions[i];
+        s.fd = dial();
+        if (s.fd < 0)
+        {
+            cout << "  [!] Connect " << i << " failed: " << strerror(errno) << "\n";
+            for (int j = 0; j < i; j++) close(sessions[j].fd);
+            return 1;
+        }
+        setNonBlocking(s.fd);
+        s.sent = s.done = s.batchLeft = 0;
+        epoll_event ev = {};
+        ev.events   = EPOLLIN;
+        ev.data.u32 = i;
+        epoll_ctl(ep, EPOLL_CTL_ADD, s.fd, &ev);
+    }
+    double connectSecs = chrono::duration<double>(chrono::steady_clock::now() - connectStart).count();
+
+    mt19937 rng(1);
+    static const char* reads[] = { "NEXT\n", "NEXT\n", "SORTED\n", "STATS\n", "FIND load 1\n" };
+    auto sendBatch = [&](Session& s) {
+        int n = min(depth, requests - s.sent);
+        for (int k = 0; k < n; k++)
+        {
+            int r = rng() % 10;
+            if (r < 2) s.out += "PRI " + to_string(1 + rng() % 64) + " " + to_string(1 + rng() % 10) + "\n";
+            else       s.out += reads[rng() % 5];
+        }
+        s.sent     += n;
+        s.batchLeft = n;
+        s.batchStart = chrono::steady_clock::now();
+        ssize_t w = write(s.fd, s.out.data(), s.out.size());
+        if (w > 0) s.out.erase(0, w);
+        if (!s.out.empty())
+        {
+            epoll_event ev = {};
+            ev.events   = EPOLLIN | EPOLLOUT;
+            ev.data.u32 = &s - &sessions[0];
+            epoll_ctl(ep, EPOLL_CTL_MOD, s.fd, &ev);
+        }
+    };
+
+    vector<uint64_t> batchMicros;
+    int  finished = 0;
+    long long completed = 0, bytes = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < clients; i++) sendBatch(sessions[i]);
+
+    const int   MAX_EVENTS = 1024;
+    epoll_event events[MAX_EVENTS];
+    char buf[64 * 1024];
+    while (finished < clients)
+    {
+        int n = epoll_wait(ep, events, MAX_EVENTS, 5000);
+        if (n == 0) { cout << "  [!] Server stopped responding.\n"; break; }
+        for (int e = 0; e < n; e++)
+        {
+            Session& s = sessions[events[e].data.u32];
+            if (!s.out.empty())
+            {
+                ssize_t w = write(s.fd, s.out.data(), s.out.size());
+                if (w > 0) s.out.erase(0, w);
+                if (s.out.empty())
+                {
+                    epoll_event ev = {};
+                    ev.events   = EPOLLIN;
+                    ev.data.u32 = events[e].data.u32;
+                    epoll_ctl(ep, EPOLL_CTL_MOD, s.fd, &ev);
+                }
+            }
+            ssize_t r;
+            while ((r = read(s.fd, buf, sizeof(buf))) > 0) { s.in.append(buf, r); bytes += r; }
+            if (r == 0) { finished++; epoll_ctl(ep, EPOLL_CTL_DEL, s.fd, nullptr); continue; }
+
+            size_t pos = 0;
+            while (true)
+            {
+                size_t nl = s.in.find('\n', pos);
+                if (nl == string::npos) break;
+                size_t len = strtoul(s.in.c_str() + s.in.find(' ', pos) + 1, nullptr, 10);
+                if (s.in.size() < nl + 1 + len) break;
+                pos = nl + 1 + len;
+                s.done++; s.batchLeft--; completed++;
+            }
+            s.in.erase(0, pos);
+
+            if (s.batchLeft == 0 && s.sent == s.done)
+            {
+                batchMicros.push_back(chrono::duration_cast<chrono::microseconds>(
+                    chrono::steady_clock::now() - s.batchStart).count());
+                if (s.sent < requests) sendBatch(s);
+                else { finished++; epoll_ctl(ep, EPOLL_CTL_DEL, s.fd, nullptr); }
+            }
+        }
+    }
+    double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    for (int i = 0; i < clients; i++) close(sessions[i].fd);
+    close(ep);
+
+    sort(batchMicros.begin(), batchMicros.end());
+    size_t nb = batchMicros.size();
+    cout << "\n  Load test against " << path << "\n";
+    cout << "  " << string(72, '-') << "\n";
+    cout << "  Sessions          : " << clients << "  (connected in "
+         << fixed << setprecision(2) << connectSecs << " s)\n";
+    cout << "  Pipeline depth    : " << depth << "\n";
+    cout << "  Requests          : " << completed << " / " << (long long)clients * requests << "\n";
+    cout << "  Elapsed           : " << setprecision(3) << secs << " s\n";
+    cout << "  Throughput        : " << setprecision(0) << completed / secs << " req/s  ("
+         << setprecision(1) << bytes / secs / (1 << 20) << " MiB/s)\n";
+    if (nb)
+        cout << "  Batch latency     : p50 " << batchMicros[(nb - 1) / 2]
+             << " us  p99 " << batchMicros[(nb - 1) * 99 / 100]
+             << " us  max " << batchMicros[nb - 1] << " us\n";
+    cout << "  " << string(72, '-') << "\n" << left;
+    return completed == (long long)clients * requests ? 0 : 1;
+}
+#endif
+
 void showMenu()
 {
     cout << "\n";
     cout << "  +==========================================+\n";
     cout << "  |          CLI TO-DO LIST APP             |\n";
-    cout << "  |  Linked List | Stack | Heap | Queue     |\n";
+    cout << "  |  List | Stack | Heap | Queue | Graph    |\n";
     cout << "  +==========================================+\n";
     cout << "  |  -- Linked List --                      |\n";
     cout << "  |   1. View all tasks                     |\n";
@@ -625,6 +2096,9 @@ void showMenu()
     cout << "  |  13. Skip current task (move to back)   |\n";
     cout << "  |  -- General --                          |\n";
     cout << "  |  14. Show stats                         |\n";
+    cout << "  |  -- Graph (Dependencies) --             |\n";
+    cout << "  |  15. Make a task depend on another      |\n";
+    cout << "  |  16. Remove a dependency                |\n";
     cout << "  |   0. Exit                               |\n";
     cout << "  +==========================================+\n";
     cout << "  Choose: ";
@@ -639,9 +2113,55 @@ int getPriority()
     return p;
 }
 
-int main()
+void usage(const char* prog)
 {
+    cout << "Usage:\n"
+         << "  " << prog << "                                   interactive menu\n"
+         << "  " << prog << " --record <trace>                  interactive, recording ops\n"
+         << "  " << prog << " --replay <trace> [--paced]        replay a trace and report latency\n"
+         << "  " << prog << " --generate <cascade|planner|depend> <n> <trace> [seed]\n"
+         << "  " << prog << " --bench-heap [ops] [trace...]     compare heap arities\n"
+#ifdef __linux__
+         << "  " << prog << " --serve <socket>                  run as a multi-client daemon\n"
+         << "  " << prog << " --loadtest <socket> [clients] [requests] [depth]\n"
+#endif
+         ;
+}
+
+int main(int argc, char** argv)
+{
+    string mode = argc > 1 ? argv[1] : "";
+    if (mode == "--replay" && (argc == 3 || argc == 4))
+        return replayTrace(argv[2], argc == 4 && string(argv[3]) == "--paced");
+    if (mode == "--generate" && (argc == 5 || argc == 6))
+        return generateTrace(argv[2], atoi(argv[3]), argv[4],
+                             argc == 6 ? (unsigned)atoi(argv[5]) : 42u);
+    if (mode == "--bench-heap")
+    {
+        int ops = 2000000, i = 2;
+        if (argc > 2 && isdigit((unsigned char)argv[2][0])) ops = atoi(argv[i++]);
+        return benchHeaps(ops, vector<string>(argv + i, argv + argc));
+    }
+#ifdef __linux__
+    if (mode == "--serve" && argc == 3)
+        return serveSocket(argv[2]);
+    if (mode == "--loadtest" && argc >= 3 && argc <= 6)
+        return loadTest(argv[2], argc > 3 ? atoi(argv[3]) : 1000,
+                        argc > 4 ? atoi(argv[4]) : 100, argc > 5 ? atoi(argv[5]) : 8);
+#endif
+    if (argc != 1 && !(mode == "--record" && argc == 3))
+        { usage(argv[0]); return 1; }
+
+    TraceRecorder* recorder = nullptr;
+    if (argc == 3)
+    {
+        recorder = new TraceRecorder(argv[2]);
+        if (!recorder->ok())
+            { cout << "  [!] Cannot write " << argv[2] << ".\n"; delete recorder; return 1; }
+    }
+
     TodoList list;
+    list.setTracer(recorder);
     list.addTask("Complete DSA mini project",         1);
     list.addTask("Submit assignment before deadline", 2);
     list.addTask("Study Linked Lists chapter",        4);
@@ -715,8 +2235,21 @@ int main()
 
         case 14: list.showStats(); break;
 
+        case 15:
+        case 16:
+        {
+            cout << "  Enter Task ID: ";
+            int id; cin >> id; cin.ignore();
+            cout << "  Enter ID of the task it depends on: ";
+            int dep; cin >> dep; cin.ignore();
+            if (choice == 15) list.addDependency(id, dep);
+            else              list.removeDependency(id, dep);
+            break;
+        }
+
         case 0:
             cout << "\n  Goodbye! Keep completing those tasks :)\n\n";
+            delete recorder;
             return 0;
 
         default: